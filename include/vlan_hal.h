@@ -100,10 +100,148 @@
 
 #define VLAN_HAL_MAX_LINE_BUFFER_LENGTH                120
 
+//initial capacity of the internal object pools, may be overridden at build time.
+//with VLAN_HAL_STATIC_POOLS defined, these pools are statically sized to these limits and do not grow,
+//so at most VLAN_HAL_MAX_PENDING_OPERATIONS operations can be queued in open batches at once.
+#ifndef VLAN_HAL_MAX_PENDING_OPERATIONS
+#define VLAN_HAL_MAX_PENDING_OPERATIONS                512
+#endif
+#ifndef VLAN_HAL_MAX_EVENT_RECORDS
+#define VLAN_HAL_MAX_EVENT_RECORDS                     256
+#endif
+
+//POSIX shared memory object holding the HAL state generation counter, see vlan_hal_getGeneration()
+#define VLAN_HAL_GENERATION_SHM_NAME                   "/vlan_hal_generation"
+
+//POSIX shared memory object holding the VLAN ID allocation bitmap, see vlan_hal_allocVlanId()
+#define VLAN_HAL_VLANID_POOL_SHM_NAME                  "/vlan_hal_vlanid_pool"
+
+//call trace file identification, see vlan_hal_trace_file_header_t
+#define VLAN_HAL_TRACE_MAGIC                           0x54484c56 // "VLHT" in little-endian byte order
+#define VLAN_HAL_TRACE_VERSION                         1
+
+//number of spans kept by the timeline recorder, see vlan_hal_enableTimeline()
+#ifndef VLAN_HAL_TIMELINE_MAX_SPANS
+#define VLAN_HAL_TIMELINE_MAX_SPANS                    16384
+#endif
+
+//compiled topology file identification, see vlan_hal_topology_header_t
+#define VLAN_HAL_TOPOLOGY_MAGIC                        0x50544c56 // "VLTP" in little-endian byte order
+#define VLAN_HAL_TOPOLOGY_VERSION                      1
+
+//vlan_hal_topology_group_t flags
+#define VLAN_HAL_TOPOLOGY_GROUP_STP_SET                0x1        // The file sets the STP state; without it, STP is left unchanged.
+#define VLAN_HAL_TOPOLOGY_GROUP_STP                    0x2        // STP state to set (on if present); only valid with _STP_SET.
+
+//platform-specific group names, appended to VLAN_HAL_GROUP_NAMES at build time,
+//e.g. -D'VLAN_HAL_PLATFORM_GROUP_NAMES(X)=X(BRLAN8, "brlan8")'
+#ifndef VLAN_HAL_PLATFORM_GROUP_NAMES
+#define VLAN_HAL_PLATFORM_GROUP_NAMES(X)
+#endif
+
+/**
+ * @brief Valid values for the `groupName`/`br_name` parameters.
+ *
+ * X-macro list of (identifier, name) pairs. The position of a name in the list
+ * is its dense slot index in `vlan_hal_group_slot_t`. Implementations generate
+ * their group-name lookup (e.g. a perfect hash) from this list at build time.
+ */
+#define VLAN_HAL_GROUP_NAMES(X) \
+    X(BRLAN0,   "brlan0")       \
+    X(BRLAN1,   "brlan1")       \
+    X(BRLAN2,   "brlan2")       \
+    X(BRLAN3,   "brlan3")       \
+    X(BRLAN4,   "brlan4")       \
+    X(BRLAN5,   "brlan5")       \
+    X(BRLAN7,   "brlan7")       \
+    X(BRLAN10,  "brlan10")      \
+    X(BRLAN106, "brlan106")     \
+    X(BRLAN403, "brlan403")     \
+    X(BRLAN112, "brlan112")     \
+    X(BRLAN113, "brlan113")     \
+    X(BREBHAUL, "brebhaul")     \
+    VLAN_HAL_PLATFORM_GROUP_NAMES(X)
+
+//number of log2 latency buckets kept per API in vlan_hal_api_stats_t
+#define VLAN_HAL_STATS_LATENCY_BUCKETS                 24
+
+//least severe log level compiled into the implementation, see vlan_hal_log_level_t.
+//DEBUG (5) and TRACE (6) messages are removed at build time unless this is raised.
+#ifndef VLAN_HAL_LOG_COMPILE_LEVEL
+#define VLAN_HAL_LOG_COMPILE_LEVEL                     4
+#endif
+
 /**********************************************************************
                 ENUMERATION DEFINITIONS
 **********************************************************************/
 
+/**
+ * @brief Identifies a HAL API in statistics, call traces and timelines.
+ *
+ * Every function declared in this header has an entry. Values are stable across
+ * releases: new APIs are only added immediately before `VLAN_HAL_API_MAX`.
+ */
+typedef enum _vlan_hal_api {
+    VLAN_HAL_API_ADD_GROUP = 0,                 // vlan_hal_addGroup()
+    VLAN_HAL_API_DEL_GROUP,                     // vlan_hal_delGroup()
+    VLAN_HAL_API_ADD_INTERFACE,                 // vlan_hal_addInterface()
+    VLAN_HAL_API_DEL_INTERFACE,                 // vlan_hal_delInterface()
+    VLAN_HAL_API_PRINT_GROUP,                   // vlan_hal_printGroup()
+    VLAN_HAL_API_PRINT_ALL_GROUP,               // vlan_hal_printAllGroup()
+    VLAN_HAL_API_DELETE_ALL_INTERFACES,         // vlan_hal_delete_all_Interfaces()
+    VLAN_HAL_API_GROUP_AVAILABLE,               // _is_this_group_available_in_linux_bridge()
+    VLAN_HAL_API_INTERFACE_AVAILABLE,           // _is_this_interface_available_in_linux_bridge()
+    VLAN_HAL_API_INTERFACE_AVAILABLE_IN_GROUP,  // _is_this_interface_available_in_given_linux_bridge()
+    VLAN_HAL_API_GET_SHELL_OUTPUTBUFFER,        // _get_shell_outputbuffer()
+    VLAN_HAL_API_INSERT_CONFIG_ENTRY,           // insert_VLAN_ConfigEntry()
+    VLAN_HAL_API_DELETE_CONFIG_ENTRY,           // delete_VLAN_ConfigEntry()
+    VLAN_HAL_API_GET_VLANID_FOR_GROUPNAME,      // get_vlanId_for_GroupName()
+    VLAN_HAL_API_PRINT_ALL_CONFIGURATION,       // print_all_vlanId_Configuration()
+    VLAN_HAL_API_BATCH_BEGIN,                   // vlan_hal_batchBegin()
+    VLAN_HAL_API_BATCH_COMMIT,                  // vlan_hal_batchCommit()
+    VLAN_HAL_API_BATCH_ABORT,                   // vlan_hal_batchAbort()
+    VLAN_HAL_API_GET_CMD_OUTPUTBUFFER,          // _get_cmd_outputbuffer()
+    VLAN_HAL_API_GET_ALL_CONFIGURATION,         // get_all_vlanId_Configuration()
+    VLAN_HAL_API_GET_GROUP_MEMBERS,             // vlan_hal_getGroupMembers()
+    VLAN_HAL_API_GET_GROUPNAME_FOR_VLANID,      // get_GroupName_for_vlanId()
+    VLAN_HAL_API_ALLOC_VLANID,                  // vlan_hal_allocVlanId()
+    VLAN_HAL_API_FREE_VLANID,                   // vlan_hal_freeVlanId()
+    VLAN_HAL_API_RESERVE_VLANID_RANGE,          // vlan_hal_reserveVlanIdRange()
+    VLAN_HAL_API_APPLY_TOPOLOGY,                // vlan_hal_applyTopology()
+    VLAN_HAL_API_COMPILE_TOPOLOGY,              // vlan_hal_compileTopology()
+    VLAN_HAL_API_GET_SHELL_OUTPUTBUFFER_RES,    // _get_shell_outputbuffer_res()
+    VLAN_HAL_API_GET_STATS,                     // vlan_hal_get_stats()
+    VLAN_HAL_API_SET_LOG_LEVEL,                 // vlan_hal_setLogLevel()
+    VLAN_HAL_API_GET_GENERATION,                // vlan_hal_getGeneration()
+    VLAN_HAL_API_SET_TRACE_FILE,                // vlan_hal_setTraceFile()
+    VLAN_HAL_API_ENABLE_TIMELINE,               // vlan_hal_enableTimeline()
+    VLAN_HAL_API_WRITE_TIMELINE,                // vlan_hal_writeTimeline()
+    VLAN_HAL_API_MAX                            // Number of entries, must be last.
+} vlan_hal_api_t;
+
+/**
+ * @brief Dense slot index of each valid group name, see `VLAN_HAL_GROUP_NAMES`.
+ */
+typedef enum _vlan_hal_group_slot {
+#define VLAN_HAL_GROUP_SLOT_ENUM(id, name) VLAN_HAL_GROUP_##id,
+    VLAN_HAL_GROUP_NAMES(VLAN_HAL_GROUP_SLOT_ENUM)
+#undef VLAN_HAL_GROUP_SLOT_ENUM
+    VLAN_HAL_GROUP_MAX                          // Number of valid group names, must be last.
+} vlan_hal_group_slot_t;
+
+/**
+ * @brief Log levels written to `vlan_vendor_hal.log`, in descending order of severity.
+ */
+typedef enum _vlan_hal_log_level {
+    VLAN_HAL_LOG_FATAL = 0,                     // Critical conditions, e.g. system failures.
+    VLAN_HAL_LOG_ERROR,                         // Non-fatal errors that impede normal operation.
+    VLAN_HAL_LOG_WARNING,                       // Potentially harmful situations.
+    VLAN_HAL_LOG_NOTICE,                        // Important but not error-level events.
+    VLAN_HAL_LOG_INFO,                          // General informational messages.
+    VLAN_HAL_LOG_DEBUG,                         // Detailed diagnostic information.
+    VLAN_HAL_LOG_TRACE                          // Fine-grained internal flow.
+} vlan_hal_log_level_t;
+
 /**********************************************************************
                 STRUCTURE DEFINITIONS
 **********************************************************************/
@@ -132,6 +270,10 @@
  *
  * @note Ensure the total size of this structure (including padding) does not
  *       exceed the `VLAN_HAL_MAX_VLANGROUP_TEXT_LENGTH` limit.
+ *
+ * @note This structure is the representation used at the API boundary.
+ *       Implementations are not required to store configuration entries in
+ *       this form internally.
  */
 typedef struct _vlan_vlanidconfiguration {
     char groupName[VLAN_HAL_MAX_VLANGROUP_TEXT_LENGTH]; // Bridge name for the VLAN group.
@@ -139,6 +281,113 @@ typedef struct _vlan_vlanidconfiguration {
     struct _vlan_vlanidconfiguration *nextlink;        // Pointer to the next configuration in the linked list.
 } vlan_vlanidconfiguration_t;
 
+/**
+ * @brief One group-to-VLAN mapping returned by `get_all_vlanId_Configuration()`.
+ */
+typedef struct _vlan_vlanid_mapping {
+    char groupName[VLAN_HAL_MAX_VLANGROUP_TEXT_LENGTH]; // Bridge name for the VLAN group.
+    char vlanID[VLAN_HAL_MAX_VLANID_TEXT_LENGTH];      // VLAN ID assigned to the group.
+} vlan_vlanid_mapping_t;
+
+/**
+ * @brief One member interface of a VLAN group, returned by `vlan_hal_getGroupMembers()`.
+ */
+typedef struct _vlan_hal_group_member {
+    char ifName[VLAN_HAL_MAX_INTERFACE_NAME_TEXT_LENGTH];     // Name of the bridge port (e.g. "l2sd0.100").
+    char baseIfName[VLAN_HAL_MAX_INTERFACE_NAME_TEXT_LENGTH]; // Underlying interface (e.g. "l2sd0"); same as ifName if untagged.
+    char vlanID[VLAN_HAL_MAX_VLANID_TEXT_LENGTH];            // VLAN ID of the port; empty string if untagged.
+} vlan_hal_group_member_t;
+
+/**
+ * @brief Statistics collected for a single HAL API.
+ *
+ * Counters are cumulative since the library was loaded and wrap around on
+ * overflow. Latencies are measured from API entry to API exit.
+ *
+ * `latencyHistogram[0]` counts calls that completed in less than 2 microseconds.
+ * `latencyHistogram[n]` (n > 0) counts calls whose latency in microseconds lies in
+ * [2^n, 2^(n+1)). The last bucket also counts all slower calls.
+ *
+ * The layout of this structure, including `VLAN_HAL_STATS_LATENCY_BUCKETS`, is
+ * fixed across releases.
+ */
+typedef struct _vlan_hal_api_stats {
+    ULONG callCount;                                        // Number of calls.
+    ULONG errorCount;                                       // Number of calls that returned RETURN_ERR.
+    ULONG cacheHitCount;                                    // Lookups answered from internal state without a kernel query.
+    ULONG cacheMissCount;                                   // Lookups that required a kernel query.
+    ULONG latencyHistogram[VLAN_HAL_STATS_LATENCY_BUCKETS]; // Log2-bucketed latency histogram.
+} vlan_hal_api_stats_t;
+
+/**
+ * @brief Header at the start of a call trace file written after `vlan_hal_setTraceFile()`.
+ *
+ * All fields of the trace file are in the byte order of the recording device.
+ */
+typedef struct _vlan_hal_trace_file_header {
+    UINT magic;                                             // VLAN_HAL_TRACE_MAGIC.
+    UINT version;                                           // VLAN_HAL_TRACE_VERSION.
+} vlan_hal_trace_file_header_t;
+
+/**
+ * @brief Fixed part of one call trace record.
+ *
+ * Each record is followed by `argCount` zero-terminated strings: the input
+ * string arguments of the call in declaration order, with an empty string for a
+ * NULL pointer. Numeric input arguments (e.g. `maxEntries`) are written in
+ * decimal. Output arguments are not recorded.
+ *
+ * `result` holds the return value of APIs that return RETURN_OK or RETURN_ERR.
+ * For APIs that return `void` (`_get_shell_outputbuffer()`) and for
+ * `vlan_hal_getGeneration()`, whose value is not meaningful in another process or
+ * on another device, it is always RETURN_OK and is not compared on replay.
+ * `_get_shell_outputbuffer_res()` is never recorded, because its `FILE *`
+ * argument cannot be written to a file or reproduced on replay.
+ */
+typedef struct _vlan_hal_trace_record {
+    unsigned long long timestampNs;                         // CLOCK_MONOTONIC time of API entry.
+    UINT durationNs;                                        // Time from API entry to API exit, saturated at UINT max.
+    UINT pid;                                               // Process ID of the caller.
+    UINT tid;                                               // Thread ID (gettid()) of the caller.
+    unsigned short api;                                     // vlan_hal_api_t of the call.
+    unsigned char argCount;                                 // Number of argument strings that follow.
+    signed char result;                                     // Return value (RETURN_OK or RETURN_ERR), RETURN_OK for APIs without one.
+} vlan_hal_trace_record_t;
+
+/**
+ * @brief Header of a compiled topology file, see `vlan_hal_compileTopology()`.
+ *
+ * The header is followed by `groupCount` `vlan_hal_topology_group_t` records and
+ * then `memberCount` `vlan_hal_topology_member_t` records, without padding. All
+ * fields are in the byte order of the target device, so the file can be mapped
+ * and used in place.
+ */
+typedef struct _vlan_hal_topology_header {
+    UINT magic;                                             // VLAN_HAL_TOPOLOGY_MAGIC.
+    UINT version;                                           // VLAN_HAL_TOPOLOGY_VERSION.
+    UINT groupCount;                                        // Number of group records.
+    UINT memberCount;                                       // Number of member records.
+} vlan_hal_topology_header_t;
+
+/**
+ * @brief One VLAN group of a compiled topology file.
+ */
+typedef struct _vlan_hal_topology_group {
+    char groupName[VLAN_HAL_MAX_VLANGROUP_TEXT_LENGTH];     // Bridge name for the VLAN group.
+    char vlanID[VLAN_HAL_MAX_VLANID_TEXT_LENGTH];          // Default VLAN ID of the group.
+    UINT flags;                                             // VLAN_HAL_TOPOLOGY_GROUP_* flags.
+    UINT mtu;                                               // Bridge MTU; 0 keeps the kernel default.
+} vlan_hal_topology_group_t;
+
+/**
+ * @brief One member interface of a compiled topology file.
+ */
+typedef struct _vlan_hal_topology_member {
+    UINT groupIndex;                                        // Index of the group record the interface belongs to; less than groupCount.
+    char ifName[VLAN_HAL_MAX_INTERFACE_NAME_TEXT_LENGTH];   // Name of the interface (e.g. "l2sd0").
+    char vlanID[VLAN_HAL_MAX_VLANID_TEXT_LENGTH];          // VLAN ID of the interface; empty selects the group's default VLAN ID.
+} vlan_hal_topology_member_t;
+
 /** @} */  //END OF GROUP VLAN_HAL_TYPES
 
 /**********************************************************************
@@ -199,6 +448,7 @@ typedef struct _vlan_vlanidconfiguration {
  * @note Possible errors:
  *       - VLAN ID is outside the valid range (1-4094).
  *       - A group with the same name exists, but with a different VLAN ID.
+ *       - The VLAN ID is already the default VLAN ID of another group.
  *       - System-level errors during bridge creation or VLAN configuration.
  *
  * @todo Refactor return codes to use a more specific and informative enum (see general TODO).
@@ -223,6 +473,9 @@ int vlan_hal_addGroup(const char *groupName, const char *default_vlanID);
  * @note Possible error scenarios include:
  *       - System-level errors during bridge deletion or interface removal.
  *
+ * @note If the group's VLAN ID was obtained from `vlan_hal_allocVlanId()`, it is
+ *       returned to the pool when the group is deleted.
+ *
  * @todo Refactor return codes to use a more specific and informative enum (see
  *       general TODO comment).
  */
@@ -242,7 +495,10 @@ int vlan_hal_delGroup(const char *groupName);
  * @param[in] ifName - The name of the network interface to be added (e.g., "eth0").
  *                     This is vendor-specific.
  * @param[in] vlanID - The VLAN ID (1-4094) to assign to the interface within the
- *                     group.
+ *                     group. NULL or an empty string selects the group's default
+ *                     VLAN ID, as in the Puma6 example at the end of this file;
+ *                     the interface is still added as the tagged sub-interface
+ *                     `<ifName>.<vlanID>`.
  *
  * @returns The status of the operation.
  * @retval RETURN_OK - The operation succeeded, or the interface was already a
@@ -274,7 +530,8 @@ int vlan_hal_addInterface(const char *groupName, const char *ifName, const char
  * @param[in] ifName - The name of the network interface to be removed (e.g., "eth0"). 
  *                     This is vendor-specific.
  * @param[in] vlanID - The VLAN ID (1-4094) associated with the interface within the
- *                     group.
+ *                     group. NULL or an empty string selects the group's default
+ *                     VLAN ID, as for `vlan_hal_addInterface()`.
  *
  * @returns The status of the operation.
  * @retval RETURN_OK - The operation succeeded, or the interface was not a
@@ -332,6 +589,35 @@ int vlan_hal_printGroup(const char *groupName);
  */
 int vlan_hal_printAllGroup();
 
+/**
+ * @brief Retrieves the member interfaces of a VLAN group.
+ *
+ * This function copies the interfaces attached to the bridge of the specified
+ * VLAN group (`groupName`) into the caller-provided array. For each member, it
+ * returns the port name, the underlying interface and the VLAN ID. The result is
+ * obtained from a single kernel query or from the implementation's cached state.
+ *
+ * @param[in] groupName - The name of the bridge representing the VLAN group
+ *                        (e.g., "brlan0"). Valid values are: brlan0, brlan1, brlan2,
+ *                        brlan3, brlan4, brlan5, brlan7, brlan10, brlan106, brlan403,
+ *                        brlan112, brlan113, brebhaul.
+ * @param[out] members - Caller-allocated array of at least `maxMembers` elements that
+ *                       receives the members. May be NULL if `maxMembers` is 0.
+ * @param[in] maxMembers - Number of elements available in `members`.
+ * @param[out] count - Receives the total number of members. If it is larger than
+ *                     `maxMembers`, only the first `maxMembers` were copied and the
+ *                     caller should retry with a larger array.
+ *
+ * @returns The status of the operation.
+ * @retval RETURN_OK - The members were copied (possibly truncated, see `count`).
+ * @retval RETURN_ERR - Invalid parameters, the group does not exist, or an error
+ *                      occurred.
+ *
+ * @todo Refactor return codes to use a more specific and informative enum (see
+ *       general TODO comment).
+ */
+int vlan_hal_getGroupMembers(const char *groupName, vlan_hal_group_member_t *members, UINT maxMembers, UINT *count);
+
 /**
  * @brief Removes all interfaces from a VLAN group.
  *
@@ -371,6 +657,10 @@ int vlan_hal_delete_all_Interfaces(const char *groupName);
  * @retval RETURN_OK - The bridge exists in the Linux bridge system.
  * @retval RETURN_ERR - The bridge was not found or an error occurred during the
  *                     check.
+ *
+ * @note Implementations should answer this with a single `faccessat()` of
+ *       `<br_name>/bridge` relative to a cached directory descriptor of
+ *       `/sys/class/net`, without spawning a process or dumping all links.
  */
 int _is_this_group_available_in_linux_bridge(char * br_name);
 
@@ -384,12 +674,19 @@ int _is_this_group_available_in_linux_bridge(char * br_name);
  *
  * @param[in] if_name - The name of the network interface to be checked 
  *                      (e.g., "eth0"). This name is vendor-specific.
- * @param[in] vlanID  - The VLAN ID (1-4094) associated with the interface.
+ * @param[in] vlanID  - The VLAN ID (1-4094) associated with the interface. Unlike
+ *                      the other APIs, NULL or an empty string is not accepted,
+ *                      because there is no group from which to take a default
+ *                      VLAN ID.
  *
  * @returns The status of the operation.
  * @retval RETURN_OK - The interface exists within a Linux bridge.
- * @retval RETURN_ERR - The interface was not found in any bridge or an error 
- *                     occurred during the check.
+ * @retval RETURN_ERR - The interface was not found in any bridge, `vlanID` is NULL
+ *                     or empty, or an error occurred during the check.
+ *
+ * @note Implementations should answer this with a single `faccessat()` of
+ *       `<if_name>.<vlanID>/brport` relative to a cached directory descriptor of
+ *       `/sys/class/net`, without spawning a process or dumping all links.
  */
 int _is_this_interface_available_in_linux_bridge(char * if_name, char *vlanID);
 
@@ -406,13 +703,21 @@ int _is_this_interface_available_in_linux_bridge(char * if_name, char *vlanID);
  *                      membership (e.g., "brlan0"). Valid values are: brlan0, brlan1, 
  *                      brlan2, brlan3, brlan4, brlan5, brlan7, brlan10, brlan106, 
  *                      brlan403, brlan112, brlan113, brebhaul.
- * @param[in] vlanID  - The VLAN ID (1-4094) associated with the interface.
+ * @param[in] vlanID  - The VLAN ID (1-4094) associated with the interface. NULL or
+ *                      an empty string selects the default VLAN ID of the group
+ *                      `br_name`, as for `vlan_hal_addInterface()`.
  *
  * @returns The status of the operation.
  * @retval RETURN_OK - The interface is a member of the specified bridge with the
  *                     given VLAN ID.
  * @retval RETURN_ERR - The interface is not a member of the bridge or an error 
  *                     occurred during the check.
+ *
+ * @note Implementations should answer this with a single `faccessat()` of
+ *       `<br_name>/brif/<if_name>.<vlanID>` relative to a cached directory
+ *       descriptor of `/sys/class/net`, without spawning a process or dumping
+ *       all links. When `vlanID` is NULL or empty, it is first resolved to the
+ *       group's VLAN ID from the configuration store.
  */
 int _is_this_interface_available_in_given_linux_bridge(char * if_name, char * br_name,char *vlanID);
 
@@ -423,6 +728,8 @@ int _is_this_interface_available_in_given_linux_bridge(char * if_name, char * br
 * @param[out] len length of the output string.
 *                 \n The maximum output length is 512.
 *
+* @note New code should use `_get_cmd_outputbuffer()`, which does not spawn a shell,
+*       enforces a timeout and is not limited to 512 bytes of output.
 *
 */
 void _get_shell_outputbuffer(char * cmd, char * out, int len);
@@ -440,6 +747,38 @@ void _get_shell_outputbuffer(char * cmd, char * out, int len);
  */
 void _get_shell_outputbuffer_res(FILE *fp, char * out, int len);
 
+/**
+ * @brief Runs an external command without a shell and captures its output.
+ *
+ * This utility function executes `argv[0]` directly (no `/bin/sh`), using
+ * `posix_spawn()` with vfork semantics, and reads the command's standard output
+ * until it exits or `timeout_ms` expires. Unlike `_get_shell_outputbuffer()`, the
+ * output is not truncated at 512 bytes: it is collected into a buffer that grows
+ * as needed.
+ *
+ * @param[in] argv - NULL-terminated argument vector. `argv[0]` is the path of the
+ *                   executable (e.g. "/usr/sbin/brctl"); it is not searched in PATH.
+ * @param[in] timeout_ms - Maximum time in milliseconds to wait for the command to
+ *                         complete. If it expires, the command is killed with
+ *                         SIGKILL and the function fails.
+ * @param[out] out - Receives a pointer to the zero-terminated output. The buffer is
+ *                   allocated with `malloc()` and must be released by the caller
+ *                   with `free()`. Set to NULL on error.
+ * @param[out] len - Receives the length of the output, excluding the terminator.
+ * @param[out] exit_status - Receives the exit status of the command as returned by
+ *                           `waitpid()`. Use `WIFEXITED()`/`WEXITSTATUS()` to decode it.
+ *
+ * @returns The status of the operation.
+ * @retval RETURN_OK - The command was run and has exited; its output and exit
+ *                     status are returned. A non-zero exit status is not an error.
+ * @retval RETURN_ERR - Invalid parameters, the command could not be spawned, the
+ *                      timeout expired, or memory could not be allocated.
+ *
+ * @todo Refactor return codes to use a more specific and informative enum (see
+ *       general TODO comment).
+ */
+int _get_cmd_outputbuffer(char * const argv[], int timeout_ms, char **out, int *len, int *exit_status);
+
 /**
  * @brief Stores the VLAN ID and group name configuration.
  *
@@ -457,7 +796,9 @@ void _get_shell_outputbuffer_res(FILE *fp, char * out, int len);
  * @returns The status of the operation.
  * @retval RETURN_OK - The configuration entry was successfully inserted.
  * @retval RETURN_ERR - An error occurred during the insertion process (e.g.,
- *                     storage error, invalid parameters).
+ *                     storage error, invalid parameters), or `vlanID` is already
+ *                     associated with a different group. Each VLAN ID belongs to
+ *                     at most one group.
  *
  * @todo Refactor return codes to use a more specific and informative enum (see
  *       general TODO comment).
@@ -510,6 +851,92 @@ int delete_VLAN_ConfigEntry(char *groupName);
  */
 int get_vlanId_for_GroupName(const char *groupName, char *vlanID);
 
+/**
+ * @brief Retrieves the group name associated with a given VLAN ID.
+ *
+ * This utility function is the reverse of `get_vlanId_for_GroupName()`. It looks
+ * up the VLAN configuration entry whose VLAN ID is `vlanID` and, if found, copies
+ * the associated group name into the provided output parameter. The lookup takes
+ * constant time and does not scan the configuration entries. The result is
+ * unique, because `insert_VLAN_ConfigEntry()` rejects a VLAN ID that is already
+ * associated with another group.
+ *
+ * @param[in] vlanID - The VLAN ID (1-4094) to look up.
+ * @param[out] groupName - Pointer to a character array of at least
+ *                         `VLAN_HAL_MAX_VLANGROUP_TEXT_LENGTH` bytes where the
+ *                         retrieved group name will be stored.
+ *
+ * @returns The status of the operation.
+ * @retval RETURN_OK - The group name was found and stored in `groupName`.
+ * @retval RETURN_ERR - The VLAN ID is invalid or not assigned to any group, or an
+ *                      error occurred during the retrieval process.
+ *
+ * @todo Refactor return codes to use a more specific and informative enum (see
+ *       general TODO comment).
+ */
+int get_GroupName_for_vlanId(const char *vlanID, char *groupName);
+
+/**
+ * @brief Allocates a free VLAN ID for a dynamic group.
+ *
+ * This function returns the lowest VLAN ID in the range 1-4094 that is not
+ * reserved by `vlan_hal_reserveVlanIdRange()`, not already allocated, and not
+ * associated with a configuration entry (see `insert_VLAN_ConfigEntry()`, which
+ * `vlan_hal_addGroup()` uses), and marks it as allocated. The allocation is
+ * atomic across all processes using the HAL.
+ *
+ * The allocated ID is intended to be passed to `vlan_hal_addGroup()`. It is
+ * returned to the pool by `vlan_hal_delGroup()` on that group, or by
+ * `vlan_hal_freeVlanId()` if the group is never created.
+ *
+ * @param[out] vlanID - Pointer to a character array of at least
+ *                      `VLAN_HAL_MAX_VLANID_TEXT_LENGTH` bytes where the allocated
+ *                      VLAN ID will be stored.
+ *
+ * @returns The status of the operation.
+ * @retval RETURN_OK - A VLAN ID was allocated and stored in `vlanID`.
+ * @retval RETURN_ERR - No VLAN ID is free, or an error occurred.
+ *
+ * @todo Refactor return codes to use a more specific and informative enum (see
+ *       general TODO comment).
+ */
+int vlan_hal_allocVlanId(char *vlanID);
+
+/**
+ * @brief Returns a VLAN ID obtained from `vlan_hal_allocVlanId()` to the pool.
+ *
+ * @param[in] vlanID - The VLAN ID (1-4094) to release.
+ *
+ * @returns The status of the operation.
+ * @retval RETURN_OK - The VLAN ID was released, or was not allocated.
+ * @retval RETURN_ERR - The VLAN ID is invalid or is still assigned to a group, or
+ *                      an error occurred.
+ *
+ * @todo Refactor return codes to use a more specific and informative enum (see
+ *       general TODO comment).
+ */
+int vlan_hal_freeVlanId(const char *vlanID);
+
+/**
+ * @brief Excludes a range of VLAN IDs from automatic allocation.
+ *
+ * VLAN IDs in the range [`firstVlanID`, `lastVlanID`] are never returned by
+ * `vlan_hal_allocVlanId()`. They remain usable with `vlan_hal_addGroup()` directly.
+ * Reservations accumulate and persist until the device reboots.
+ *
+ * @param[in] firstVlanID - First VLAN ID (1-4094) of the range.
+ * @param[in] lastVlanID - Last VLAN ID (1-4094) of the range. Must not be less than
+ *                         `firstVlanID`.
+ *
+ * @returns The status of the operation.
+ * @retval RETURN_OK - The range was reserved.
+ * @retval RETURN_ERR - The range is invalid, or an error occurred.
+ *
+ * @todo Refactor return codes to use a more specific and informative enum (see
+ *       general TODO comment).
+ */
+int vlan_hal_reserveVlanIdRange(const char *firstVlanID, const char *lastVlanID);
+
 /**
  * @brief Prints all stored VLAN ID and group name configurations.
  *
@@ -527,6 +954,339 @@ int get_vlanId_for_GroupName(const char *groupName, char *vlanID);
  */
 int print_all_vlanId_Configuration(void);
 
+/**
+ * @brief Retrieves all stored VLAN ID and group name configurations in one call.
+ *
+ * This function copies every configuration entry stored by
+ * `insert_VLAN_ConfigEntry()` into the caller-provided array, together with
+ * the generation number of the configuration store at the time of the copy.
+ * The copy is consistent: it is never interleaved with a concurrent update.
+ *
+ * @param[out] entries - Caller-allocated array of at least `maxEntries` elements
+ *                       that receives the mappings. May be NULL if `maxEntries` is 0.
+ * @param[in] maxEntries - Number of elements available in `entries`.
+ * @param[out] count - Receives the total number of stored entries. If it is larger
+ *                     than `maxEntries`, only the first `maxEntries` were copied and
+ *                     the caller should retry with a larger array.
+ * @param[out] generation - Optional. If not NULL, receives the HAL state generation
+ *                          (see `vlan_hal_getGeneration()`) that the copy
+ *                          corresponds to, so callers can skip a refresh when it
+ *                          has not changed.
+ *
+ * @returns The status of the operation.
+ * @retval RETURN_OK - The entries were copied (possibly truncated, see `count`).
+ * @retval RETURN_ERR - Invalid parameters, or an error occurred.
+ *
+ * @todo Refactor return codes to use a more specific and informative enum (see
+ *       general TODO comment).
+ */
+int get_all_vlanId_Configuration(vlan_vlanid_mapping_t *entries, UINT maxEntries, UINT *count, ULONG *generation);
+
+/**
+ * @brief Starts queuing VLAN operations for a batched kernel submission.
+ *
+ * After this call, `vlan_hal_addGroup()`, `vlan_hal_delGroup()`,
+ * `vlan_hal_addInterface()` and `vlan_hal_delInterface()` validate their
+ * arguments and queue the resulting kernel requests instead of submitting them
+ * one at a time. The queue is submitted by `vlan_hal_batchCommit()`, which
+ * coalesces the requests into as few system calls as the implementation allows
+ * (e.g. multiple netlink messages per buffer, `sendmmsg()`/`recvmmsg()`), or is
+ * discarded by `vlan_hal_batchAbort()`.
+ *
+ * A batch belongs to the calling thread. Calls made by other threads or processes
+ * while the batch is open are not queued; they are applied immediately, as if no
+ * batch were open. Batches do not nest. Calling this function while the calling
+ * thread already has an open batch is an error.
+ *
+ * Each queued operation is validated against the state that the earlier
+ * operations of the same batch will produce. For example, `vlan_hal_addInterface()`
+ * is accepted for a group whose `vlan_hal_addGroup()` is queued earlier in the
+ * batch, and rejected for a group whose `vlan_hal_delGroup()` is queued earlier.
+ * Requests are submitted in queuing order, so the kernel creates the group
+ * before it processes the interface.
+ *
+ * @returns The status of the operation.
+ * @retval RETURN_OK - The batch was opened.
+ * @retval RETURN_ERR - The calling thread already has an open batch, or an error
+ *                      occurred.
+ *
+ * @note Queued operations return RETURN_OK when they pass validation and are
+ *       queued, and RETURN_ERR (without being queued) when they do not, or when
+ *       no more operations can be queued (see `VLAN_HAL_MAX_PENDING_OPERATIONS`).
+ *       The batch stays open in both cases. The outcome of the kernel requests
+ *       is reported by `vlan_hal_batchCommit()`.
+ *       Queuing an operation changes only the calling thread's queue. The
+ *       configuration store, the VLAN ID pool and the generation returned by
+ *       `vlan_hal_getGeneration()` are not updated until the batch is committed.
+ *
+ * @todo Refactor return codes to use a more specific and informative enum (see
+ *       general TODO comment).
+ */
+int vlan_hal_batchBegin(void);
+
+/**
+ * @brief Submits all operations queued by the calling thread since `vlan_hal_batchBegin()`.
+ *
+ * The queued requests are submitted in order and the batch is closed. The kernel
+ * processes every submitted request, even after one of them fails, so a failure
+ * does not prevent later requests from being applied. The outcome of each
+ * operation is therefore reported individually.
+ *
+ * The configuration store and the allocation bits of the VLAN ID pool are updated
+ * here, once for each operation whose request the kernel acknowledged, and in
+ * queuing order. Operations that the kernel rejected leave them unchanged. The
+ * whole commit counts as one change of the generation returned by
+ * `vlan_hal_getGeneration()`.
+ *
+ * @param[out] results - Optional. Caller-allocated array of at least `maxResults`
+ *                       elements. Element `i` receives RETURN_OK or RETURN_ERR for
+ *                       the `i`-th queued operation (in queuing order).
+ * @param[in] maxResults - Number of elements available in `results`.
+ * @param[out] count - Optional. Receives the number of operations in the batch. If
+ *                     it is larger than `maxResults`, only the first `maxResults`
+ *                     results were stored.
+ *
+ * @returns The status of the operation.
+ * @retval RETURN_OK - All queued operations were applied, or the batch was empty.
+ * @retval RETURN_ERR - The calling thread has no open batch, or at least one of the
+ *                      queued operations failed (see `results`).
+ *
+ * @todo Refactor return codes to use a more specific and informative enum (see
+ *       general TODO comment).
+ */
+int vlan_hal_batchCommit(int *results, UINT maxResults, UINT *count);
+
+/**
+ * @brief Discards all operations queued by the calling thread since `vlan_hal_batchBegin()`.
+ *
+ * No queued request is submitted to the kernel, and the batch is closed. The
+ * configuration store, the VLAN ID pool and the generation are left unchanged.
+ *
+ * @returns The status of the operation.
+ * @retval RETURN_OK - The batch was discarded.
+ * @retval RETURN_ERR - The calling thread has no open batch.
+ *
+ * @todo Refactor return codes to use a more specific and informative enum (see
+ *       general TODO comment).
+ */
+int vlan_hal_batchAbort(void);
+
+/**
+ * @brief Applies a complete VLAN topology from a file in one pass.
+ *
+ * This function loads a topology description (groups, VLAN IDs, member
+ * interfaces and bridge attributes) and validates all of it before changing
+ * anything. It then applies it in batches (see `vlan_hal_batchBegin()`) of at most
+ * `VLAN_HAL_MAX_PENDING_OPERATIONS` operations each. Groups and interfaces that
+ * already exist with the expected settings are left unchanged, so the same file
+ * can be applied again to reconcile the system.
+ * Bridge attributes (STP, MTU) of existing groups are set to the values in the
+ * file; attributes the file leaves unspecified are not changed.
+ *
+ * The file is either the text format described in the VLAN HAL specification or
+ * the compiled form produced by `vlan_hal_compileTopology()`. The compiled form is
+ * recognised by `VLAN_HAL_TOPOLOGY_MAGIC`; it is mapped with `mmap()` and used
+ * without parsing. Before anything is applied, every `groupIndex` is checked
+ * against `groupCount` and every fixed-size string is checked for a terminating
+ * NUL, so a truncated or corrupted file is rejected.
+ *
+ * For both forms, validation also checks that each group VLAN ID is used by at
+ * most one group in the file, and is not the default VLAN ID of an existing
+ * group that is not in the file, so `vlan_hal_addGroup()` cannot fail on a
+ * duplicate VLAN ID partway through the batch.
+ *
+ * @param[in] path - Path of the topology file (e.g. "/etc/vlan_topology.bin").
+ *
+ * @returns The status of the operation.
+ * @retval RETURN_OK - The topology was applied.
+ * @retval RETURN_ERR - The file could not be read or failed validation (nothing was
+ *                      changed), or at least one operation failed when applied.
+ *                      The other operations may have been applied; each failure
+ *                      is logged.
+ *
+ * @todo Refactor return codes to use a more specific and informative enum (see
+ *       general TODO comment).
+ */
+int vlan_hal_applyTopology(const char *path);
+
+/**
+ * @brief Compiles a text topology file into its binary form.
+ *
+ * This utility function parses and validates the text topology file `srcPath`
+ * and writes the equivalent compiled file, made of `vlan_hal_topology_header_t`,
+ * `vlan_hal_topology_group_t` and `vlan_hal_topology_member_t` records, to
+ * `dstPath`. It is intended to run at build time or on first boot, so that
+ * later boots can apply the compiled file with `vlan_hal_applyTopology()`.
+ *
+ * @param[in] srcPath - Path of the text topology file.
+ * @param[in] dstPath - Path of the compiled file to create. An existing file is
+ *                      replaced atomically.
+ *
+ * @returns The status of the operation.
+ * @retval RETURN_OK - The compiled file was written.
+ * @retval RETURN_ERR - The source file could not be read or failed validation, or
+ *                      the compiled file could not be written.
+ *
+ * @todo Refactor return codes to use a more specific and informative enum (see
+ *       general TODO comment).
+ */
+int vlan_hal_compileTopology(const char *srcPath, const char *dstPath);
+
+/**
+ * @brief Retrieves a snapshot of the per-API call statistics.
+ *
+ * This function copies the call counts, error counts, cache hit/miss counts and
+ * latency histograms of the HAL APIs into the caller-provided array, indexed by
+ * `vlan_hal_api_t`. The statistics are always collected; taking a snapshot does
+ * not reset them.
+ *
+ * The array is sized by the caller, so a caller built against an older header
+ * (with a smaller `VLAN_HAL_API_MAX`) receives the entries it knows about, and a
+ * caller built against a newer header sees zeroed statistics for APIs that the
+ * library does not implement.
+ *
+ * @param[out] api - Caller-allocated array of at least `maxApis` elements that
+ *                   receives the statistics. Element `i` describes the API whose
+ *                   `vlan_hal_api_t` value is `i`.
+ * @param[in] maxApis - Number of elements available in `api`, normally
+ *                      `VLAN_HAL_API_MAX`.
+ * @param[out] count - Receives the number of APIs known to the library. If it is
+ *                     larger than `maxApis`, only the first `maxApis` entries were
+ *                     copied. If it is smaller, the remaining entries are zeroed.
+ *
+ * @returns The status of the operation.
+ * @retval RETURN_OK - The snapshot was stored in `api`.
+ * @retval RETURN_ERR - `api` or `count` is NULL, or an error occurred.
+ *
+ * @note Calls to `vlan_hal_get_stats()` itself are not counted.
+ *
+ * @todo Refactor return codes to use a more specific and informative enum (see
+ *       general TODO comment).
+ */
+int vlan_hal_get_stats(vlan_hal_api_stats_t *api, UINT maxApis, UINT *count);
+
+/**
+ * @brief Returns the current HAL state generation.
+ *
+ * The generation is a sequence counter shared by all processes. It is incremented
+ * to an odd value before the HAL state is changed, and to an even value once the
+ * change is complete. HAL state changes are groups or interfaces added or
+ * deleted, and configuration entries inserted or deleted through the HAL. A
+ * committed batch, `vlan_hal_applyTopology()` or `vlan_hal_delete_all_Interfaces()`
+ * counts as a single change, so the value stays odd until it has fully completed.
+ *
+ * A query result is current only if the generation read before the query and
+ * the generation read after it are equal and even. If either value is odd, the
+ * caller must retry or treat the result as stale. Callers that cache the results
+ * of `get_vlanId_for_GroupName()`, `get_GroupName_for_vlanId()` or
+ * `get_all_vlanId_Configuration()` can keep using them while the generation
+ * stays at that even value.
+ *
+ * @note Changes made outside the HAL (e.g. a link removed by a driver or by
+ *       another tool) do not change the generation. Results of the bridge
+ *       predicates (`_is_this_*_available_in_*linux_bridge()`) and of
+ *       `vlan_hal_getGroupMembers()` reflect kernel state and must not be cached
+ *       on the basis of the generation alone.
+ *
+ * The counter is also published in the POSIX shared memory object
+ * `VLAN_HAL_GENERATION_SHM_NAME` as a single naturally aligned `ULONG` at offset 0.
+ * Processes that run as the user owning the object can map it read-only and
+ * check it with a single atomic acquire load, without calling into the HAL.
+ *
+ * @returns The current generation. It is odd while a change is in progress. It
+ *          wraps around on overflow, so it must only be compared for equality.
+ */
+ULONG vlan_hal_getGeneration(void);
+
+/**
+ * @brief Starts or stops recording of HAL API calls to a binary trace file.
+ *
+ * Recording is system-wide. It covers calls made by every process that uses the
+ * HAL, including processes started after recording began, until any process
+ * stops it. While recording is active, every call to a HAL API listed in
+ * `vlan_hal_api_t`, except `_get_shell_outputbuffer_res()` (see
+ * `vlan_hal_trace_record_t`), appends one `vlan_hal_trace_record_t`, followed by
+ * its argument strings, to the trace file. Each record carries the caller's
+ * process and thread IDs, so that interleaved calls can be attributed. The file starts
+ * with a `vlan_hal_trace_file_header_t`. Records are buffered and written in the
+ * background, so recording does not add file I/O to the API path.
+ *
+ * @param[in] path - Path of the trace file to create, e.g.
+ *                   "/rdklogs/logs/vlan_hal_trace.bin". An existing file is
+ *                   replaced. NULL stops recording in all processes and flushes
+ *                   the file.
+ *
+ * @returns The status of the operation.
+ * @retval RETURN_OK - Recording was started or stopped.
+ * @retval RETURN_ERR - The file could not be created, or an error occurred.
+ *
+ * @todo Refactor return codes to use a more specific and informative enum (see
+ *       general TODO comment).
+ */
+int vlan_hal_setTraceFile(const char *path);
+
+/**
+ * @brief Enables or disables the timeline recorder.
+ *
+ * While enabled, the HAL records a begin/end span for every API call and for every
+ * kernel interaction made within it (socket operations, link dumps, sysfs checks
+ * and spawned commands such as `_get_shell_outputbuffer()`). Spans are kept in
+ * memory; when `VLAN_HAL_TIMELINE_MAX_SPANS` is reached, the oldest spans are
+ * overwritten. A span that is being overwritten while the timeline is written
+ * is left out of the file. Recorded spans are kept when the recorder is disabled.
+ *
+ * @param[in] enable - TRUE to start recording, FALSE to stop.
+ *
+ * @returns The status of the operation.
+ * @retval RETURN_OK - The recorder state was changed.
+ * @retval RETURN_ERR - An error occurred (e.g., the span buffer could not be
+ *                      allocated).
+ *
+ * @todo Refactor return codes to use a more specific and informative enum (see
+ *       general TODO comment).
+ */
+int vlan_hal_enableTimeline(BOOL enable);
+
+/**
+ * @brief Writes the recorded timeline spans to a Chrome trace file.
+ *
+ * This function writes all spans recorded since the previous call in the Chrome
+ * Trace Event JSON format, which can be loaded in `chrome://tracing` or Perfetto,
+ * and clears them. Timestamps use `CLOCK_MONOTONIC`, so the file can be merged
+ * with traces of other components recorded on the same boot.
+ *
+ * @param[in] path - Path of the JSON file to create (e.g.
+ *                   "/rdklogs/logs/vlan_hal_timeline.json"). An existing file is
+ *                   replaced.
+ *
+ * @returns The status of the operation.
+ * @retval RETURN_OK - The file was written.
+ * @retval RETURN_ERR - The file could not be written, or an error occurred.
+ *
+ * @todo Refactor return codes to use a more specific and informative enum (see
+ *       general TODO comment).
+ */
+int vlan_hal_writeTimeline(const char *path);
+
+/**
+ * @brief Sets the least severe log level written to `vlan_vendor_hal.log`.
+ *
+ * Messages less severe than `level` are discarded before they are formatted.
+ * Messages less severe than `VLAN_HAL_LOG_COMPILE_LEVEL` are removed at build time
+ * and cannot be enabled at runtime.
+ *
+ * @param[in] level - The least severe level to log (VLAN_HAL_LOG_FATAL to
+ *                    VLAN_HAL_LOG_TRACE). The default is VLAN_HAL_LOG_INFO.
+ *
+ * @returns The status of the operation.
+ * @retval RETURN_OK - The level was applied.
+ * @retval RETURN_ERR - `level` is out of range.
+ *
+ * @todo Refactor return codes to use a more specific and informative enum (see
+ *       general TODO comment).
+ */
+int vlan_hal_setLogLevel(vlan_hal_log_level_t level);
+
 /** @} */  //END OF GROUP VLAN_HAL_APIS
 
 /*